@@ -0,0 +1,51 @@
+#ifndef AGG_H
+#define AGG_H
+
+#include "catalog.h"
+
+// memory the group table may use before groups spill, in pages
+const int AGGMEMPAGES = 256;
+
+// partitions the records of spilled groups are split into per pass
+const int AGGPARTS = 8;
+
+// spill passes after which every group is kept in memory anyway
+const int AGGMAXDEPTH = 3;
+
+// aggregate functions
+enum AggFunc
+{
+    AGGCOUNT,
+    AGGSUM,
+    AGGMIN,
+    AGGMAX,
+    AGGAVG
+};
+
+// one aggregate of the select list
+struct AggSpec
+{
+    AggFunc func;
+    const attrInfo *attr; // NULL for COUNT(*)
+};
+
+// Computes aggs over the relation of the aggregated attributes, one result
+// record per distinct value of groupAttr, or a single record if groupAttr
+// is NULL. relation names the relation when every aggregate is COUNT(*).
+//
+// A result record holds the group value (if grouped) followed by each
+// aggregate in order: COUNT as an INTEGER, SUM in the type of its attribute
+// (INTEGER or FLOAT), MIN and MAX like their attribute, AVG as a FLOAT.
+// result must already exist with that layout.
+//
+// Groups live in an open addressing hash table. Once the table outgrows
+// AGGMEMPAGES, records of groups not already in it are written to AGGPARTS
+// temporary heap files by hash and each is aggregated on its own afterwards.
+// An ungrouped COUNT(*) is answered from the relation's record count.
+const Status QU_Aggregate(const string &result,
+                          const string &relation,
+                          const attrInfo *groupAttr,
+                          const int aggCnt,
+                          const AggSpec aggs[]);
+
+#endif
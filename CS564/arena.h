@@ -0,0 +1,60 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stdlib.h>
+
+// bytes an arena gets from malloc at a time, unless one allocation is larger
+const int ARENABLOCKSIZE = 64 * 1024;
+
+// A bump allocator for memory that lives as long as one statement: record
+// and projection buffers, bound constants and other operator state.
+// alloc() hands out the next bytes of the current block; nothing is freed
+// on its own. reset() gives everything back at once by rewinding to the
+// first block, and the blocks are kept, so a statement executed again
+// allocates nothing from malloc.
+//
+// Objects placed in an arena have their destructors skipped, so only
+// buffers and plain structs belong there.
+class Arena
+{
+public:
+    Arena();
+    ~Arena();
+
+    // size bytes aligned for any built-in type, valid until reset()
+    void *alloc(const size_t size);
+
+    // room for n objects of a type without a destructor
+    template <class T>
+    T *allocArray(const size_t n) { return (T *)alloc(n * sizeof(T)); }
+
+    // like alloc(), zero filled
+    void *allocZero(const size_t size);
+
+    // give back everything allocated so far
+    void reset();
+
+    // bytes handed out since the last reset
+    const size_t getUsed() const { return used; }
+
+private:
+    struct Block
+    {
+        Block *next;
+        size_t size; // bytes of data following the header
+    };
+
+    static char *blockData(Block *block) { return (char *)(block + 1); }
+    void *nextBlock(const size_t size);
+
+    Arena(const Arena &);
+    Arena &operator=(const Arena &);
+
+    Block *first;
+    Block *current;
+    char *top;   // next free byte of current
+    char *limit; // end of current
+    size_t used;
+};
+
+#endif
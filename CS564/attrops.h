@@ -0,0 +1,18 @@
+#ifndef ATTROPS_H
+#define ATTROPS_H
+
+#include "heapfile.h"
+
+// Comparison and hashing of attribute values in their stored form, shared
+// by the indexes and the join, sort and aggregation operators.
+
+// <0, 0 or >0 as a is less than, equal to or greater than b. STRINGs
+// compare like strncmp over len bytes, the way HeapFileScan compares them.
+const int compareAttr(const char *a, const char *b, const Datatype type, const int len);
+
+// hash of a value, consistent with compareAttr: values that compare equal
+// hash alike. Different seeds give independent hash functions.
+const unsigned int hashAttr(const char *key, const Datatype type, const int len,
+                            const unsigned int seed = 0);
+
+#endif
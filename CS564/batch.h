@@ -0,0 +1,117 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <vector>
+#include "catalog.h"
+#include "dict.h"
+#include "iterator.h"
+
+// tuples per batch
+const int BATCHSIZE = 1024;
+
+// the values of one attribute for every row of a batch, back to back
+struct BatchColumn
+{
+    AttrDesc desc;     // where the attribute is in the scanned records
+    vector<char> data; // BATCHSIZE * desc.attrLen bytes
+};
+
+// Up to BATCHSIZE tuples in column form. The selection vector lists the
+// rows still qualifying after the filters so far; filters narrow it
+// instead of moving values around.
+struct ColumnBatch
+{
+    int rowCnt;               // rows in the batch
+    bool allSelected;         // every row qualifies; sel is not used
+    int selCnt;               // qualifying rows
+    int sel[BATCHSIZE];       // their row numbers, ascending
+    vector<BatchColumn> cols;
+
+    const int selected(const int i) const { return allSelected ? i : sel[i]; }
+    const int getSelCnt() const { return allSelected ? rowCnt : selCnt; }
+};
+
+// A pull-based operator passing batches instead of tuples. The batch
+// handed back by next() stays valid until the next call.
+class BatchIterator
+{
+public:
+    virtual ~BatchIterator() {}
+
+    virtual const Status open() = 0;
+    virtual const Status next(ColumnBatch *&batch) = 0; // FILEEOF at the end
+    virtual const Status close() = 0;
+};
+
+// Reads the records of a relation into batches holding just the attributes
+// in cols, one column each.
+class BatchScan : public BatchIterator
+{
+public:
+    BatchScan(const string &relation, const vector<AttrDesc> &cols);
+    ~BatchScan();
+
+    const Status open();
+    const Status next(ColumnBatch *&batch);
+    const Status close();
+
+private:
+    string relation;
+    HeapFileScan *scan;
+    ColumnBatch batch;
+};
+
+// Narrows the selection of each batch of child to the rows whose column
+// col satisfies "col op filter", or whose code is in codeFilter.
+class BatchFilter : public BatchIterator
+{
+public:
+    // filter is the constant as text, like QU_Select's attrValue
+    BatchFilter(BatchIterator *child, const int col, const Operator op, const char *filter);
+    BatchFilter(BatchIterator *child, const int col, const CodeFilter &codeFilter);
+    ~BatchFilter();
+
+    const Status open() { return child->open(); }
+    const Status next(ColumnBatch *&batch);
+    const Status close() { return child->close(); }
+
+private:
+    BatchIterator *child;
+    int col;
+    Operator op;
+    vector<char> value; // constant in binary form
+    bool hasCodeFilter;
+    CodeFilter codeFilter;
+};
+
+// Turns the selected rows of child's batches back into tuples made of the
+// columns outCols, in that order.
+class BatchTupleIterator : public TupleIterator
+{
+public:
+    BatchTupleIterator(Arena &arena, BatchIterator *child, const vector<int> &outCols, const int tupleLen);
+    ~BatchTupleIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close() { return child->close(); }
+    const int getTupleLen() const { return tupleLen; }
+
+private:
+    BatchIterator *child;
+    vector<int> outCols;
+    int tupleLen;
+    ColumnBatch *batch;
+    int pos;             // next selected row of batch to hand out
+    char *tuple;
+};
+
+// aggregate primitives over the selected rows of a column; minValue and
+// maxValue are folded into, so the caller seeds them (e.g. with a value of
+// the column) and can carry them across batches
+const long long batchSumInt(const ColumnBatch &batch, const int col);
+const double batchSumFloat(const ColumnBatch &batch, const int col);
+void batchMinMaxInt(const ColumnBatch &batch, const int col, int &minValue, int &maxValue);
+void batchMinMaxFloat(const ColumnBatch &batch, const int col, float &minValue, float &maxValue);
+
+#endif
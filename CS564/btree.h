@@ -0,0 +1,96 @@
+#ifndef BTREE_H
+#define BTREE_H
+
+#include <vector>
+#include "heapfile.h"
+
+// header page of a B+-tree index file
+struct BTreeHdrPage
+{
+    int magic;    // BTREEMAGIC
+    int keyType;  // Datatype of the indexed attribute
+    int keyLen;   // length of the indexed attribute
+    int rootPage; // page number of the root node
+    int height;   // number of levels, 1 when the root is a leaf
+};
+
+const int BTREEMAGIC = 0x42545245;
+
+// fixed part of every node page; entries follow it
+struct BTNodeHdr
+{
+    int level;      // 0 for leaves
+    int keyCnt;     // entries in the node
+    int nextPage;   // next leaf to the right, -1 if none (leaves only)
+    int firstChild; // subtree left of the first entry (internal nodes only)
+};
+
+// A disk-based B+-tree from attribute values to RIDs, kept in its own DB
+// file and read through the buffer manager.
+//
+// Entries are ordered by (key, rid), so duplicate keys are allowed and every
+// entry has exactly one place in the tree. A leaf entry is key + RID; an
+// internal entry is key + RID + the page number of the subtree holding
+// entries >= it. Deletes remove the leaf entry and never rebalance, so
+// nodes may run below half full. Every changed node is logged (see wal.h).
+class BTreeIndex
+{
+public:
+    // create an empty index file for keys of the given type and length
+    static const Status create(const string &indexName, const Datatype keyType, const int keyLen);
+
+    BTreeIndex(const string &indexName, Status &status);
+    ~BTreeIndex();
+
+    const Status insertEntry(const char *key, const RID &rid);
+    const Status deleteEntry(const char *key, const RID &rid);
+
+    // empty the index: the root becomes an empty leaf, logged like any
+    // other change, and the other nodes are returned in oldPages for
+    // disposePages() once that change has committed
+    const Status clear(std::vector<int> &oldPages);
+    const Status disposePages(const std::vector<int> &pageNos);
+
+    // position on the first entry in range. A NULL bound leaves that end
+    // of the range open; the flags say whether a bound itself qualifies.
+    const Status startScan(const char *lowKey, const bool lowInclusive,
+                           const char *highKey, const bool highInclusive);
+    // RID of the next entry in range, FILEEOF past the end of the range
+    const Status scanNext(RID &outRid);
+    const Status endScan();
+
+    const Datatype getKeyType() const { return (Datatype)hdrPage->keyType; }
+    const int getKeyLen() const { return hdrPage->keyLen; }
+    const int getHeight() const { return hdrPage->height; }
+
+private:
+    const int compareKey(const char *a, const char *b) const;
+    const int compareEntry(const char *aKey, const RID &aRid, const char *bKey, const RID &bRid) const;
+    const int entrySize(const int level) const;
+    const int capacity(const int level) const;
+    char *entryAt(Page *page, const int level, const int i) const;
+    const int findPos(Page *page, const char *key, const RID &rid) const;
+    const int childFor(Page *page, const char *key, const RID &rid) const;
+
+    const Status insertInto(const int pageNo, const char *key, const RID &rid,
+                            bool &split, char *upEntry, int &upPage);
+    const Status newNode(const int level, int &pageNo, Page *&page);
+    const Status unPinDirty(const int pageNo, const Page *page);
+
+    string indexName;
+    File *filePtr;
+    int headerPageNo;
+    BTreeHdrPage *hdrPage; // pinned for the life of the object
+    bool hdrDirtyFlag;
+
+    // scan state; the current leaf stays pinned during a scan
+    Page *scanPage;
+    int scanPageNo;
+    int scanPos;
+    char *lowKey;
+    bool lowInclusive;
+    char *highKey;
+    bool highInclusive;
+};
+
+#endif
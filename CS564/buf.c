@@ -23,6 +23,7 @@
 #include <stdio.h>
 #include "page.h"
 #include "buf.h"
+#include "wal.h"
 
 #define ASSERT(c)  { if (!(c)) { \
                        cerr << "At line " << __LINE__ << ":" << endl << "  "; \
@@ -70,7 +71,10 @@ BufMgr::~BufMgr() {
                  << " from frame " << i << endl;
 #endif
 
+            if (logMgr != NULL)
+                logMgr->flushForPage(tmpbuf->file, tmpbuf->pageNo);
             tmpbuf->file->writePage(tmpbuf->pageNo, &(bufPool[i]));
+            bufStats.diskwrites++;
         }
     }
 
@@ -96,9 +100,15 @@ const Status BufMgr::allocBuf(int & frame)
         } else if (!tmpbuf->refbit && tmpbuf->pinCnt == 0) {
             // If frame is not referenced & pinCnt > 0, use it after writing if dirty
             if (tmpbuf->dirty) {
+                // an uncommitted change may only reach disk once the log can undo it
+                if (logMgr != NULL) {
+                    Status status = logMgr->flushForPage(tmpbuf->file, tmpbuf->pageNo);
+                    if (status != OK) {
+                        return status;
+                    }
+                }
                 // Write page back to disk
                 tmpbuf->file->writePage(tmpbuf->pageNo, &bufPool[clockHand]);
-                bufStats.accesses++;
                 bufStats.diskwrites++; // increment disk writes
                 tmpbuf->dirty = false;
 
@@ -139,10 +149,12 @@ const Status BufMgr::readPage(File* file, const int PageNo, Page*& page)
     // first check whether page is already in buffer pool
     int frameNo;
     Status status = hashTable->lookup(file, PageNo, frameNo);
-    bufStats.diskreads++;
+    // every pin is an access; only a miss is a disk read
+    bufStats.accesses++;
 
     // case 1: page is not in buffer pool
     if (status == HASHNOTFOUND) {
+            bufStats.diskreads++;
             // allocate a buffer frame
             status = allocBuf(frameNo);
             if (status != OK) {
@@ -251,6 +263,8 @@ const Status BufMgr::allocPage(File* file, int& pageNo, Page*& page)
         return status;
     }
     bufTable[frameNo].Set(file, pageNo);
+    // a new page is pinned without being read
+    bufStats.accesses++;
     // return the page number of the newly allocated page and a pointer to the buffer frame allocated for the page
     page = &bufPool[frameNo];
     pageNo = bufTable[frameNo].pageNo;
@@ -290,9 +304,13 @@ const Status BufMgr::flushFile(const File* file)
         cout << "flushing page " << tmpbuf->pageNo
              << " from frame " << i << endl;
 #endif
+        if (logMgr != NULL &&
+            (status = logMgr->flushForPage(tmpbuf->file, tmpbuf->pageNo)) != OK)
+          return status;
         if ((status = tmpbuf->file->writePage(tmpbuf->pageNo,
                                               &(bufPool[i]))) != OK)
           return status;
+        bufStats.diskwrites++;
 
         tmpbuf->dirty = false;
       }
@@ -311,6 +329,39 @@ const Status BufMgr::flushFile(const File* file)
   return OK;
 }
 
+/**
+ * Drops every page of a file from the buffer pool without writing any of
+ * them back, for a file that is about to be destroyed. Returns OK if no
+ * errors occurred, PAGEPINNED if a page of the file is still pinned and
+ * BADBUFFER if an invalid frame still names the file.
+ *
+ * File *file: the file whose pages are dropped
+ * Returns: OK if no errors occurred, PAGEPINNED or BADBUFFER otherwise
+ */
+const Status BufMgr::discardFile(const File* file)
+{
+  for (int i = 0; i < numBufs; i++) {
+    BufDesc* tmpbuf = &(bufTable[i]);
+    if (tmpbuf->valid == true && tmpbuf->file == file) {
+
+      if (tmpbuf->pinCnt > 0)
+          return PAGEPINNED;
+
+      hashTable->remove(file,tmpbuf->pageNo);
+
+      tmpbuf->file = NULL;
+      tmpbuf->pageNo = -1;
+      tmpbuf->dirty = false;
+      tmpbuf->valid = false;
+    }
+
+    else if (tmpbuf->valid == false && tmpbuf->file == file)
+      return BADBUFFER;
+  }
+
+  return OK;
+}
+
 
 void BufMgr::printSelf(void)
 {
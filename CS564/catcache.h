@@ -0,0 +1,60 @@
+#ifndef CATCACHE_H
+#define CATCACHE_H
+
+#include <map>
+#include <vector>
+#include "catalog.h"
+
+// the cached catalog entries of one relation
+struct CachedRel
+{
+    vector<AttrDesc> attrs;           // in attrcat order
+    std::map<string, int> attrIndex;  // attribute name -> position in attrs
+    int recLen;                       // length of the relation's records
+};
+
+// An in-memory copy of the attrcat entries of the relations used so far, so
+// that looking up a relation's schema does not scan attrcat every time.
+// A relation is read from attrcat on first use and kept until invalidated.
+//
+// Anything that changes a relation's catalog entries (creating or destroying
+// it, adding or removing attributes) must call invalidate() for it; creating
+// and destroying a relation's file does so itself (see ddl.h). Every
+// invalidation bumps the cache version, so holders of resolved descriptors
+// can tell whether they need to resolve them again.
+class CatalogCache
+{
+public:
+    CatalogCache();
+    ~CatalogCache();
+
+    // all attributes of relation; attrs stays valid until the relation is
+    // invalidated and must not be freed by the caller
+    const Status getRelInfo(const string &relation, int &attrCnt, const AttrDesc *&attrs);
+
+    // one attribute of relation, ATTRNOTFOUND if it has no such attribute
+    const Status getInfo(const string &relation, const string &attrName, AttrDesc &record);
+
+    // length of the records of relation
+    const Status getRecLen(const string &relation, int &recLen);
+
+    // forget the cached entries of relation
+    void invalidate(const string &relation);
+
+    // forget everything
+    void invalidateAll();
+
+    // changes whenever something is invalidated
+    const unsigned int getVersion() const { return version; }
+
+private:
+    const Status lookup(const string &relation, CachedRel *&rel);
+
+    std::map<string, CachedRel *> rels;
+    unsigned int version;
+};
+
+// the catalog cache in front of attrCat
+extern CatalogCache catCache;
+
+#endif
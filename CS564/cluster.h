@@ -0,0 +1,123 @@
+#ifndef CLUSTER_H
+#define CLUSTER_H
+
+#include <map>
+#include <vector>
+#include "catalog.h"
+#include "predicate.h"
+
+// name of the heap file listing the clustered relations
+#define CLUSTERCATNAME "clustcat"
+
+// bytes of a key kept in a page's key range; longer STRINGs keep a prefix
+const int CLUSTERKEYLEN = 16;
+
+// one clustcat record
+struct ClusterDesc
+{
+    char relName[MAXNAME];
+    char attrName[MAXNAME];       // the clustering key
+    char zoneFile[MAXNAMESIZE];   // heap file of the PageZones
+    int attrOffset;
+    int attrType;
+    int attrLen;
+    int keyLen;                   // bytes of each bound, min(attrLen, CLUSTERKEYLEN)
+    int tailPage;                 // first page of the unsorted tail, -1 for all of
+                                  // them, in which case zoneFile is not read
+};
+
+// the smallest and largest key on one sorted page of a clustered relation
+struct PageZone
+{
+    int pageNo;
+    char low[CLUSTERKEYLEN];
+    char high[CLUSTERKEYLEN];
+};
+
+// a clustered relation as kept in memory
+struct ClusterInfo
+{
+    ClusterDesc desc;
+    vector<PageZone> zones; // the sorted pages, in key order
+};
+
+// Keeps relations clustered on a key: their records sorted on it, and the
+// key range of every sorted page remembered, so a range predicate on the
+// key only reads the pages whose range overlaps it.
+//
+// cluster() sorts a relation with sortHeapFile and loads it back in order,
+// writing a PageZone for every page it fills but the last. Records inserted
+// later are appended from that last page on, the unsorted tail, which range
+// scans read in full; deletes leave the ranges of the sorted pages wide but
+// correct. A relation is only reclustered when QU_Cluster is run on it
+// again. Anything that moves records out of key order (truncating, updating
+// the key) must call resetZones().
+//
+// Every record gets a new RID when the relation is loaded back, so its
+// index entries are dropped and inserted again.
+class ClusterMgr
+{
+public:
+    ClusterMgr(Status &status);
+
+    // sort relation on attrName and load it back in that order
+    const Status cluster(const string &relation, const string &attrName);
+
+    // forget the sorted pages of relation, leaving all of it tail until it
+    // is clustered again
+    const Status resetZones(const string &relation);
+
+    // stop clustering relation and destroy its zone file
+    const Status dropRelation(const string &relation);
+
+    // how relation is clustered, RELNOTFOUND if it isn't
+    const Status getCluster(const string &relation, const ClusterInfo *&info) const;
+
+private:
+    const Status save(const ClusterInfo &info);
+    const Status removeDesc(const string &relation);
+
+    std::map<string, ClusterInfo> clusters;
+};
+
+// the cluster manager; NULL when no relation is clustered. Like the index
+// manager, it has to be there before a clustered relation is changed.
+extern ClusterMgr *clusterMgr;
+
+// A heap file read in key order over the sorted pages of a clustered
+// relation whose range can hold a match, then over its unsorted tail.
+class ClusteredFileScan : public HeapFile
+{
+public:
+    ClusteredFileScan(const string &name, Status &status);
+    ~ClusteredFileScan();
+
+    // scan for the records satisfying pred, with lowKey and highKey bounding
+    // the clustering key (NULL for an open end). The first sorted page read
+    // is found by binary search on the page ranges; sorted pages end with
+    // the first one whose range starts past highKey. info and the keys must
+    // outlive the scan.
+    const Status startScan(const ClusterInfo &info, const ScanPredicate &pred,
+                           const char *lowKey, const char *highKey);
+
+    // next matching record; rec points into the pinned page
+    const Status scanNext(RID &outRid, Record &rec);
+
+    const Status endScan();
+
+    const int getPageCnt() const { return headerPage->pageCnt; }
+
+private:
+    const Status nextPage();
+
+    const ClusterInfo *info;
+    ScanPredicate pred;
+    const char *highKey;
+    unsigned int zonePos; // next sorted page to read
+    bool inTail;
+};
+
+// CLUSTER relation ON attrName
+const Status QU_Cluster(const string &relation, const string &attrName);
+
+#endif
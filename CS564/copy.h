@@ -0,0 +1,23 @@
+#ifndef COPY_H
+#define COPY_H
+
+#include "catalog.h"
+
+// bytes of the input file read at a time
+const int COPYCHUNKSIZE = 64 * 1024;
+
+// rows appended between two log commits
+const int COPYCOMMITROWS = 10000;
+
+// Bulk loads a relation from a delimited text file, one record per line
+// with the fields in catalog order (e.g. delimiter ',' for CSV, '\t' for
+// TSV). Fields are not quoted; a field longer than its STRING attribute is
+// truncated. Rows loaded before an error stay in the relation.
+//
+// rowCnt is set to the number of rows appended. Returns OK on success,
+// UNIXERR if the file can't be read, ATTRTYPEMISMATCH on a line with the
+// wrong number of fields, or the first error from the insert path.
+const Status QU_Copy(const string &relation, const string &fileName,
+                     const char delimiter, int &rowCnt);
+
+#endif
@@ -0,0 +1,57 @@
+#ifndef DATAGEN_H
+#define DATAGEN_H
+
+#include <vector>
+#include "catalog.h"
+
+// length of the name attribute of generated relations
+const int GENNAMELEN = 32;
+
+// how the key attribute of generated rows is distributed
+enum KeyDist
+{
+    UNIFORMKEYS, // every key in [0, keyCnt) equally likely
+    ZIPFKEYS     // key k drawn with probability proportional to 1 / (k+1)^skew
+};
+
+struct GenSpec
+{
+    int keyCnt;              // keys are in [0, keyCnt)
+    KeyDist dist;
+    double skew;             // zipf exponent, ignored for uniform keys
+    int nameCnt;             // distinct values of the name attribute
+    unsigned long long seed; // same seed, same rows
+};
+
+// A deterministic generator of synthetic rows for benchmarks, with the
+// schema (id INTEGER, key INTEGER, val FLOAT, name STRING(GENNAMELEN)).
+// ids count up from 0; names repeat every nameCnt keys, so the name
+// attribute is skewed the same way as the key.
+class DataGen
+{
+public:
+    DataGen(const GenSpec &spec);
+
+    // create relation with the generator's schema, stored on FixedPages
+    static const Status createRel(const string &relation);
+
+    // the next key, drawn from the key distribution
+    const int nextKey();
+
+    // a uniform value in [0, 1)
+    const double nextDouble();
+
+    // append rowCnt rows to relation through a prepared insert, counting
+    // in keyCnts (resized to keyCnt if needed) how many got each key
+    const Status load(const string &relation, const int rowCnt, vector<int> &keyCnts);
+
+private:
+    const unsigned long long next64();
+
+    GenSpec spec;
+    unsigned long long state;
+    int nextId;
+    vector<double> cdf; // zipf: cdf[k] = P(key <= k)
+};
+
+#endif
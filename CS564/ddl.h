@@ -0,0 +1,24 @@
+#ifndef DDL_H
+#define DDL_H
+
+#include "catalog.h"
+
+// creates relation through relCat->createRel, on FixedPages if its
+// records fit them
+const Status createRelation(const string &relation, const int attrCnt, const attrInfo attrList[]);
+
+// What is kept about a relation beside the catalog (its cached catalog
+// entries, indexes, clustering, dictionaries and statistics) must not outlive it. Every
+// relation file is created by createHeapFile and destroyed by
+// destroyHeapFile, whoever asks for it (relCat->createRel and
+// relCat->destroyRel included), and these two call the hooks below, so no
+// caller has to remember to.
+
+// fileName was just created; forget anything cached under its name
+void heapFileCreated(const string &fileName);
+
+// fileName was just destroyed; drop everything kept about a relation of
+// that name
+const Status heapFileDestroyed(const string &fileName);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef DELSCAN_H
+#define DELSCAN_H
+
+#include <vector>
+#include "heapfile.h"
+#include "predicate.h"
+#include "dict.h"
+
+// A heap file opened for set-based deletes: whole pages at a time instead
+// of a scanNext/deleteRecord round trip per record.
+class DeleteFileScan : public HeapFile
+{
+public:
+    DeleteFileScan(const string &name, Status &status);
+
+    // delete every record: the first page and the header are reset to an
+    // empty file and committed, then the pages after the first are given
+    // back to the file. With oldPages, nothing is committed or given back;
+    // the pages after the first are returned there instead, for the caller
+    // to pass to disposePages() once its own changes have committed.
+    const Status truncate(std::vector<int> *oldPages = NULL);
+
+    // give back pages that are no longer in the file's chain
+    const Status disposePages(const std::vector<int> &pageNos);
+
+    // delete the record at rid, e.g. one just inserted whose index entries
+    // could not be added
+    const Status deleteRecord(const RID &rid);
+
+    // delete the records satisfying pred (every record if it isn't set) and,
+    // if given, codeFilter. Each page is read, has all of its matching
+    // records removed, and is written back dirty once; the record count in
+    // the header is updated once per page. With maintainIndexes the index
+    // entries of relation are dropped for each deleted record.
+    const Status deleteWhere(const ScanPredicate &pred,
+                             const CodeFilter *codeFilter,
+                             const string &relation,
+                             const bool maintainIndexes,
+                             int &delCnt);
+};
+
+#endif
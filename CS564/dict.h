@@ -0,0 +1,126 @@
+#ifndef DICT_H
+#define DICT_H
+
+#include <map>
+#include <vector>
+#include "catalog.h"
+
+// name of the heap file recording which attributes are dictionary encoded
+#define DICTCATNAME "dictcat"
+
+// one dictcat record
+struct DictCatRec
+{
+    char relName[MAXNAME];      // relation with an encoded attribute
+    char attrName[MAXNAME];     // the encoded attribute
+    char dictName[MAXNAMESIZE]; // heap file holding the dictionary
+    int attrLen;                // length of the decoded STRING values
+};
+
+// The dictionary of one encoded STRING attribute. Values are kept in memory
+// and mirrored to a heap file of (code, value) records; codes are assigned
+// in arrival order starting at 0. The heap file is kept open for appending
+// from the first new value on.
+class StringDict
+{
+public:
+    StringDict(const string &dictName, const int attrLen);
+    ~StringDict();
+
+    // read the dictionary's heap file, creating it if it doesn't exist
+    const Status load();
+
+    // code of value, adding it to the dictionary if it is new
+    const Status encode(const char *value, int &code);
+
+    // code of value, ATTRNOTFOUND if it is not in the dictionary
+    const Status lookup(const char *value, int &code) const;
+
+    // value of code, attrLen bytes copied into out
+    const Status decode(const int code, char *out) const;
+
+    // marks in codes every code whose value satisfies "value op filter",
+    // compared the way HeapFileScan compares STRING attributes
+    void matchCodes(const Operator op, const char *filter, vector<char> &codes) const;
+
+    const int getAttrLen() const { return attrLen; }
+    const int getCodeCnt() const { return values.size(); }
+    const string &getName() const { return dictName; }
+
+private:
+    const string key(const char *value) const;
+
+    string dictName;
+    int attrLen;
+    std::map<string, int> codeOf;
+    vector<string> values;
+    InsertFileScan *appender; // the heap file, once a value has been added
+    vector<char> recBuf;      // (code, value) record being added
+};
+
+// A predicate on an encoded attribute that can't be a single integer
+// compare: the set of qualifying codes, tested at attrOffset of each record.
+struct CodeFilter
+{
+    int attrOffset;
+    vector<char> codes; // codes[c] != 0 if code c qualifies
+
+    const bool match(const char *data) const
+    {
+        int code;
+        memcpy(&code, data + attrOffset, sizeof(int));
+        return code >= 0 && code < (int)codes.size() && codes[code];
+    }
+};
+
+// Keeps track of the dictionary encoded attributes. The catalog describes an
+// encoded attribute as an INTEGER holding the code; dictcat remembers its
+// dictionary and decoded length. Dictionaries are loaded on first use.
+class DictMgr
+{
+public:
+    DictMgr(Status &status);
+    ~DictMgr();
+
+    // dictionary of relation.attrName, ATTRNOTFOUND if it is not encoded
+    const Status getDict(const string &relation, const string &attrName, StringDict *&dict);
+
+    // start encoding relation.attrName, whose catalog entry must be an
+    // INTEGER; its values are STRINGs of length attrLen
+    const Status encodeAttr(const string &relation, const string &attrName, const int attrLen);
+
+    // make relation.attrName use an existing dictionary, e.g. for an
+    // attribute of a query result projected from an encoded attribute
+    const Status shareDict(const string &relation, const string &attrName, const StringDict *dict);
+
+    // forget the encoded attributes of relation (its dictionaries are kept)
+    const Status dropRelation(const string &relation);
+
+    // rewrite "attr op value" on an encoded attribute. EQ and NE become an
+    // integer compare, returned as a decimal code in codeStr; any other
+    // operator fills codeFilter and leaves codeStr empty.
+    const Status rewrite(StringDict *dict, const AttrDesc &attrDesc, const Operator op,
+                         const char *value, char *codeStr, CodeFilter &codeFilter);
+
+private:
+    typedef std::pair<string, string> AttrKey;
+
+    const Status addEntry(const string &relation, const string &attrName,
+                          const string &dictName, const int attrLen);
+    StringDict *openDict(const string &dictName, const int attrLen, Status &status);
+
+    std::map<AttrKey, string> dictNameOf;
+    std::map<string, StringDict *> dicts;
+    std::map<string, int> attrLenOf; // decoded length by dictionary name
+};
+
+// the dictionary manager; NULL disables dictionary encoding
+extern DictMgr *dictMgr;
+
+// ENCODE relation.attrName AS STRING(attrLen): the attribute's values become
+// attrLen-byte STRINGs stored as dictionary codes. Its catalog entry must be
+// an INTEGER, and the relation must be empty, since the INTEGERs already
+// stored are not codes. Creates the dictionary manager if there is none.
+const Status QU_Encode(const string &relation, const string &attrName, const int attrLen);
+
+#endif
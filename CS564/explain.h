@@ -0,0 +1,82 @@
+#ifndef EXPLAIN_H
+#define EXPLAIN_H
+
+#include <iostream>
+#include "iterator.h"
+#include "scanstats.h"
+
+// what one operator did, its inputs included
+struct OpStats
+{
+    long long rowsOut;
+    long long pins;     // buffer pool pages pinned
+    long long misses;   // pins that had to read the page from disk
+    long long writes;   // dirty pages the buffer pool wrote back
+    long long examined; // records a HeapFileScan predicate looked at
+    long long pages;    // data pages a HeapFileScan moved to
+    long long inserted; // records an InsertFileScan appended
+    long long wallUsecs;
+    long long cpuUsecs;
+};
+
+// Adds up the buffer pool and heap file counters and the wall and CPU time
+// between each begin() and the end() that follows it.
+class OpMeter
+{
+public:
+    OpMeter();
+
+    void begin();
+    void end();
+
+    const OpStats &getStats() const { return stats; }
+    void countRow() { stats.rowsOut++; }
+
+private:
+    long long pins;
+    long long misses;
+    long long writes;
+    ScanStats scan;
+    long long wallUsecs;
+    long long cpuUsecs;
+
+    OpStats stats;
+};
+
+// Wraps an operator of a plan and measures it for EXPLAIN ANALYZE. Every
+// open(), next() and close() of the operator is metered, so the figures
+// include whatever the operator's own inputs did. input is the instrumented
+// operator feeding this one, or NULL; its rows out are this one's rows in.
+//
+// Metering is a handful of loads and two clock_gettime calls per tuple, so
+// it is only added to plans when asked for.
+class ExplainIterator : public TupleIterator
+{
+public:
+    ExplainIterator(TupleIterator *child, const string &label, const ExplainIterator *input);
+    ~ExplainIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return child->getTupleLen(); }
+
+    const OpStats &getStats() const { return meter.getStats(); }
+
+    // one line per operator, this one first and its inputs indented below
+    void print(ostream &out, const int depth = 0) const;
+
+private:
+    TupleIterator *child;
+    string label;
+    const ExplainIterator *input;
+    OpMeter meter;
+};
+
+// Runs plan, whose topmost instrumented operator is top, into the relation
+// result like materialize() and prints the plan with what every operator
+// did, under a line for the inserts into result.
+const Status explainAnalyze(TupleIterator &plan, const ExplainIterator &top,
+                            const string &result, ostream &out);
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef FIXEDPAGE_H
+#define FIXEDPAGE_H
+
+#include "heapfile.h"
+
+// marks a heap file whose data pages are FixedPages
+const int FIXEDMAGIC = 0x46495844;
+
+// header page of a heap file, including the fields that follow FileHdrPage
+struct FixedFileHdrPage : public FileHdrPage
+{
+    int magic;  // FIXEDMAGIC for a fixed-length file, 0 otherwise
+    int recLen; // length of every record of a fixed-length file
+};
+
+// A data page for relations whose records all have the same length.
+// Records sit in a dense array behind a presence bitmap, so a RID's slot
+// number maps straight to an offset and no slot directory is kept.
+// Occupies exactly one Page frame.
+class FixedPage
+{
+public:
+    void init(const int pageNo, const int recLen);
+    const Status getNextPage(int &pageNo) const;
+    const Status setNextPage(const int pageNo);
+    const Status insertRecord(const Record &rec, RID &rid);
+    const Status deleteRecord(const RID &rid);
+    const Status firstRecord(RID &firstRid) const;
+    const Status nextRecord(const RID &curRid, RID &nextRid) const;
+    const Status getRecord(const RID &rid, Record &rec);
+
+    // records of length recLen that fit on one page
+    static const int capacityFor(const int recLen);
+
+private:
+    const bool isSet(const int slot) const { return (data[slot >> 3] >> (slot & 7)) & 1; }
+    const int nextSet(int slot) const;
+    char *recordAt(const int slot) { return (char *)data + (capacity + 7) / 8 + slot * recLen; }
+
+    int nextPage;    // page number of next page
+    int curPage;     // page number of this page
+    short recLen;    // length of each record
+    short capacity;  // number of record slots
+    short recCnt;    // number of slots in use
+    short firstFree; // no free slot below this one
+    unsigned char data[PAGESIZE - 2 * sizeof(int) - 4 * sizeof(short)]; // bitmap, then records
+};
+
+inline const bool isFixedHeapFile(const FileHdrPage *hdrPage)
+{
+    return ((const FixedFileHdrPage *)hdrPage)->magic == FIXEDMAGIC;
+}
+
+// creates a heap file that stores recLen-byte records on FixedPages
+const Status createFixedHeapFile(const string fileName, const int recLen);
+
+// replaces fileName, an empty heap file nothing has open, with an empty
+// file of FixedPages for recLen-byte records; for relations, whose file
+// relCat->createRel makes with slotted pages. A file whose records don't
+// fit on a FixedPage is left as it is.
+const Status refitFixedHeapFile(const string fileName, const int recLen);
+
+// data page operations of the heap file layer, for either page format
+void pageInit(const FileHdrPage *hdrPage, Page *page, const int pageNo);
+const Status pageGetNextPage(const FileHdrPage *hdrPage, const Page *page, int &pageNo);
+const Status pageSetNextPage(const FileHdrPage *hdrPage, Page *page, const int pageNo);
+const Status pageInsertRecord(const FileHdrPage *hdrPage, Page *page, const Record &rec, RID &rid);
+const Status pageDeleteRecord(const FileHdrPage *hdrPage, Page *page, const RID &rid);
+const Status pageFirstRecord(const FileHdrPage *hdrPage, const Page *page, RID &firstRid);
+const Status pageNextRecord(const FileHdrPage *hdrPage, const Page *page, const RID &curRid, RID &nextRid);
+const Status pageGetRecord(const FileHdrPage *hdrPage, Page *page, const RID &rid, Record &rec);
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef HASHINDEX_H
+#define HASHINDEX_H
+
+#include <vector>
+#include "heapfile.h"
+
+const int HASHMAGIC = 0x48415348;
+const int HASHMAXDEPTH = 15;                        // directory holds at most 2^15 buckets
+const int HASHDIRPERPAGE = PAGESIZE / sizeof(int);  // directory entries per page
+const int HASHMAXDIRPAGES = (1 << HASHMAXDEPTH) / HASHDIRPERPAGE;
+
+// header page of a hash index file
+struct HashHdrPage
+{
+    int magic;       // HASHMAGIC
+    int keyType;     // Datatype of the indexed attribute
+    int keyLen;      // length of the indexed attribute
+    int globalDepth; // the directory has 2^globalDepth entries
+    int dirPageCnt;  // pages in use for the directory
+    int dirPages[HASHMAXDIRPAGES];
+};
+
+// fixed part of every bucket page; key + RID entries follow it
+struct HashBucketHdr
+{
+    int localDepth;   // hash bits shared by every entry of the bucket
+    int entryCnt;     // entries on this page
+    int overflowPage; // next page of the bucket's chain, -1 if none
+};
+
+// An extendible hash index from attribute values to RIDs, kept in its own
+// DB file and read through the buffer manager.
+//
+// The directory maps the low globalDepth bits of a key's hash to a bucket.
+// A full bucket splits and the directory doubles as needed, up to
+// HASHMAXDEPTH. Buckets whose entries all share the same hash (many
+// duplicates of one key) can't be split and grow an overflow chain
+// instead. Deletes never merge buckets. Every changed page is logged (see
+// wal.h); the overflow pages a split frees are reused by later buckets of
+// the same HashIndex rather than given back to the file, since disposing
+// of a page can't be undone.
+class HashIndex
+{
+public:
+    // create an empty index file for keys of the given type and length
+    static const Status create(const string &indexName, const Datatype keyType, const int keyLen);
+
+    HashIndex(const string &indexName, Status &status);
+    ~HashIndex();
+
+    const Status insertEntry(const char *key, const RID &rid);
+    const Status deleteEntry(const char *key, const RID &rid);
+
+    // empty the index: the first bucket becomes the only one and the
+    // directory a single entry, logged like any other change; the pages
+    // no longer used are returned in oldPages for disposePages() once that
+    // change has committed
+    const Status clear(std::vector<int> &oldPages);
+    const Status disposePages(const std::vector<int> &pageNos);
+
+    // position on the entries whose key equals key
+    const Status startScan(const char *key);
+    // RID of the next entry with the scan key, FILEEOF after the last one
+    const Status scanNext(RID &outRid);
+    const Status endScan();
+
+private:
+    const unsigned int hash(const char *key) const;
+    const bool equalKey(const char *a, const char *b) const;
+    const int entrySize() const { return hdrPage->keyLen + sizeof(RID); }
+    const int capacity() const { return (PAGESIZE - sizeof(HashBucketHdr)) / entrySize(); }
+    char *entryAt(Page *page, const int i) const;
+
+    const Status getDir(const int i, int &bucketPageNo);
+    const Status setDir(const int i, const int bucketPageNo);
+    const Status doubleDir();
+    const Status newBucket(const int localDepth, int &pageNo, Page *&page);
+    const Status appendToChain(const int bucketPageNo, const char *entry, const bool allowOverflow);
+    const Status splitBucket(const unsigned int h, const int bucketPageNo, bool &split);
+    const Status unPinDirty(const int pageNo, const Page *page);
+
+    string indexName;
+    File *filePtr;
+    int headerPageNo;
+    HashHdrPage *hdrPage; // pinned for the life of the object
+    bool hdrDirtyFlag;
+    std::vector<int> sparePages; // overflow pages freed by splits
+
+    // scan state; the current bucket page stays pinned during a scan
+    Page *scanPage;
+    int scanPageNo;
+    int scanPos;
+    char *scanKey;
+};
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef INDEX_H
+#define INDEX_H
+
+#include <map>
+#include <vector>
+#include "catalog.h"
+#include "btree.h"
+#include "hashindex.h"
+
+// name of the heap file listing the indexes on relation attributes
+#define INDEXCATNAME "indexcat"
+
+// kinds of index
+enum IndexType
+{
+    BTREE = 1,
+    HASH = 2
+};
+
+// one indexcat record
+struct IndexDesc
+{
+    char relName[MAXNAME];       // indexed relation
+    char attrName[MAXNAME];      // indexed attribute
+    char indexName[MAXNAMESIZE]; // DB file holding the index
+    int attrOffset;              // attribute position in the record
+    int attrType;                // Datatype of the attribute
+    int attrLen;                 // length of the attribute
+    int indexType;               // IndexType
+};
+
+// Keeps track of the indexes on relation attributes and keeps them up to
+// date. The list of indexes is read from indexcat once; index files are
+// opened on first use and stay open.
+class IndexMgr
+{
+public:
+    IndexMgr(Status &status);
+    ~IndexMgr();
+
+    // create an index on relation.attrName and fill it from the relation
+    const Status createIndex(const string &relation, const string &attrName, const IndexType indexType);
+
+    // drop the indexes of relation and destroy their files
+    const Status dropRelation(const string &relation);
+
+    // empty the indexes of relation, whose records have all been deleted,
+    // as part of the caller's logged changes. The index pages let go are
+    // returned in oldPages by index name, for disposePages() once the
+    // caller has committed.
+    const Status clearRelation(const string &relation, std::map<string, vector<int> > &oldPages);
+    const Status disposePages(const std::map<string, vector<int> > &oldPages);
+
+    // the B+-tree on relation.attrName, ATTRNOTFOUND if there is none
+    const Status getBTree(const string &relation, const string &attrName, BTreeIndex *&index);
+
+    // the hash index on relation.attrName, ATTRNOTFOUND if there is none
+    const Status getHash(const string &relation, const string &attrName, HashIndex *&index);
+
+    // RIDs of the records of relation whose attrName equals key, from a
+    // hash index or else a B+-tree; ATTRNOTFOUND if neither exists
+    const Status lookupEQ(const string &relation, const string &attrName,
+                          const char *key, vector<RID> &rids);
+
+    // add / remove the entries of a record in every index of relation; if
+    // adding one fails, the ones already added are removed again
+    const Status insertEntries(const string &relation, const Record &rec, const RID &rid);
+    const Status deleteEntries(const string &relation, const Record &rec, const RID &rid);
+
+    // true if relation has any index, so writers know to maintain them
+    const bool hasIndexes(const string &relation) const;
+
+private:
+    const IndexDesc *findIndex(const string &relation, const string &attrName, const int indexType) const;
+    void closeIndex(const string &indexName);
+    const Status openIndex(const IndexDesc &desc, BTreeIndex *&index);
+    const Status openIndex(const IndexDesc &desc, HashIndex *&index);
+    const Status insertEntry(const IndexDesc &desc, const char *key, const RID &rid);
+    const Status deleteEntry(const IndexDesc &desc, const char *key, const RID &rid);
+
+    vector<IndexDesc> indexes;
+    std::map<string, BTreeIndex *> btrees; // open B+-trees by index name
+    std::map<string, HashIndex *> hashes;  // open hash indexes by index name
+};
+
+// the index manager; NULL when indexes are not in use
+extern IndexMgr *indexMgr;
+
+// CREATE [HASH] INDEX ON relation(attrName): a B+-tree or a hash index,
+// loaded from the records already there. Creates the index manager if
+// there is none.
+const Status QU_CreateIndex(const string &relation, const string &attrName, const IndexType indexType);
+
+#endif
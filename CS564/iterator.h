@@ -0,0 +1,266 @@
+#ifndef ITERATOR_H
+#define ITERATOR_H
+
+#include <vector>
+#include "catalog.h"
+#include "projection.h"
+#include "dict.h"
+#include "index.h"
+#include "cluster.h"
+#include "arena.h"
+#include "mmapscan.h"
+
+// A pull-based query operator. open() prepares it, each next() hands back
+// the next tuple and close() releases what open() acquired. Plans are trees
+// of iterators that pass tuples up one at a time, so a consumer reading the
+// result once never pays for writing it to a relation; materialize() is the
+// sink for when a relation is wanted.
+//
+// An iterator built on top of others owns them and deletes them. Tuple
+// buffers and bound constants come from the statement's arena, passed to
+// the constructor, and go away with it rather than with the iterator.
+class TupleIterator
+{
+public:
+    virtual ~TupleIterator() {}
+
+    virtual const Status open() = 0;
+
+    // next tuple, getTupleLen() bytes that stay valid until the next call;
+    // FILEEOF once the tuples run out
+    virtual const Status next(const char *&tuple) = 0;
+
+    virtual const Status close() = 0;
+
+    virtual const int getTupleLen() const = 0;
+};
+
+// The records of a relation satisfying "attr op filter" (every record if
+// attrDesc is NULL) and, if set, a code filter; projected on the fly if a
+// projection is given, else handed back whole. filter is the constant as
+// text, like QU_Select's attrValue.
+class ScanIterator : public TupleIterator
+{
+public:
+    ScanIterator(Arena &arena,
+                 const string &relation,
+                 const int recLen,
+                 const AttrDesc *attrDesc,
+                 const Operator op,
+                 const char *filter,
+                 const CodeFilter *codeFilter,
+                 const Projection *projection);
+    ~ScanIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return projection != NULL ? projection->getTupleLen() : recLen; }
+
+private:
+    string relation;
+    int recLen;
+    bool hasAttr;
+    AttrDesc attrDesc;
+    Operator op;
+    char *filter; // constant in the attribute's binary form
+    bool hasCodeFilter;
+    CodeFilter codeFilter;
+    const Projection *projection;
+
+    ProjectedFileScan *scan;
+    char *tuple;
+};
+
+// The same records as a ScanIterator, read by a MappedFileScan straight out
+// of the mapped DB file instead of through the buffer pool. For read-only
+// full scans of large relations, which would otherwise push everything else
+// out of the pool; open() fails with PAGEPINNED if the relation is open.
+class MappedScanIterator : public TupleIterator
+{
+public:
+    MappedScanIterator(Arena &arena,
+                       const string &relation,
+                       const int recLen,
+                       const AttrDesc *attrDesc,
+                       const Operator op,
+                       const char *filter,
+                       const CodeFilter *codeFilter,
+                       const Projection *projection);
+    ~MappedScanIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return projection != NULL ? projection->getTupleLen() : recLen; }
+
+private:
+    string relation;
+    int recLen;
+    bool hasAttr;
+    AttrDesc attrDesc;
+    Operator op;
+    char *filter; // constant in the attribute's binary form
+    bool hasCodeFilter;
+    CodeFilter codeFilter;
+    const Projection *projection;
+
+    MappedFileScan *scan;
+    char *tuple;
+};
+
+// The records of a relation found through an index: a hash index probe for
+// EQ, else a B+-tree range scan for attr op filter.
+class IndexScanIterator : public TupleIterator
+{
+public:
+    IndexScanIterator(Arena &arena,
+                      const string &relation,
+                      const int recLen,
+                      const AttrDesc &attrDesc,
+                      const Operator op,
+                      const char *filter,
+                      BTreeIndex *btree,
+                      HashIndex *hash,
+                      const Projection *projection);
+    ~IndexScanIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return projection != NULL ? projection->getTupleLen() : recLen; }
+
+private:
+    string relation;
+    int recLen;
+    Operator op;
+    char *key;
+    BTreeIndex *btree;
+    HashIndex *hash;
+    const Projection *projection;
+
+    HeapFile *file;
+    char *tuple;
+};
+
+// The records of a relation clustered on attrDesc satisfying attr op
+// filter, read from the sorted pages whose key range can hold them and from
+// the unsorted tail. op must not be NE.
+class ClusterScanIterator : public TupleIterator
+{
+public:
+    ClusterScanIterator(Arena &arena,
+                        const string &relation,
+                        const int recLen,
+                        const AttrDesc &attrDesc,
+                        const Operator op,
+                        const char *filter,
+                        const ClusterInfo &cluster,
+                        const Projection *projection);
+    ~ClusterScanIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return projection != NULL ? projection->getTupleLen() : recLen; }
+
+private:
+    string relation;
+    int recLen;
+    AttrDesc attrDesc;
+    Operator op;
+    char *key;
+    const ClusterInfo *cluster;
+    const Projection *projection;
+
+    ClusteredFileScan *scan;
+    char *tuple;
+};
+
+// projects the tuples of child
+class ProjectIterator : public TupleIterator
+{
+public:
+    ProjectIterator(Arena &arena, TupleIterator *child, const Projection *projection);
+    ~ProjectIterator();
+
+    const Status open() { return child->open(); }
+    const Status next(const char *&tuple);
+    const Status close() { return child->close(); }
+    const int getTupleLen() const { return projection->getTupleLen(); }
+
+private:
+    TupleIterator *child;
+    const Projection *projection;
+    char *tuple;
+};
+
+// The tuples of child sorted on key, an attribute of child's tuples. open()
+// drains child into a temporary heap file and sorts it with sortHeapFile.
+class SortIterator : public TupleIterator
+{
+public:
+    SortIterator(TupleIterator *child, const AttrDesc &key);
+    ~SortIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return child->getTupleLen(); }
+
+private:
+    TupleIterator *child;
+    AttrDesc key;
+    string sorted;
+    HeapFileScan *scan;
+};
+
+// The first limit tuples of child (LIMIT). Once they are handed back child
+// is not pulled again, so a scan below stops early.
+class LimitIterator : public TupleIterator
+{
+public:
+    LimitIterator(TupleIterator *child, const int limit);
+    ~LimitIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close() { return child->close(); }
+    const int getTupleLen() const { return child->getTupleLen(); }
+
+private:
+    TupleIterator *child;
+    int limit;
+    int returned;
+};
+
+// The limit tuples of child that come first in ascending order of key,
+// handed back in that order (ORDER BY key LIMIT limit). open() drains child
+// through a bounded max-heap of limit tuples, so memory stays at limit
+// tuples however large child is and nothing is written to disk.
+class TopNIterator : public TupleIterator
+{
+public:
+    TopNIterator(Arena &arena, TupleIterator *child, const AttrDesc &key, const int limit);
+    ~TopNIterator();
+
+    const Status open();
+    const Status next(const char *&tuple);
+    const Status close();
+    const int getTupleLen() const { return tupleLen; }
+
+private:
+    TupleIterator *child;
+    AttrDesc key;
+    int limit;
+    int tupleLen;
+
+    char *tuples;        // limit slots of tupleLen bytes
+    vector<int> heap;    // slots in use, worst tuple first until sorted
+    unsigned int pos;    // next entry of heap to hand back
+};
+
+// runs plan and writes every tuple it produces into the relation result
+const Status materialize(TupleIterator &plan, const string &result);
+
+#endif
@@ -0,0 +1,46 @@
+#ifndef JOIN_H
+#define JOIN_H
+
+#include "catalog.h"
+
+// memory the hash join may use for its hash table, in pages
+const int JOINMEMPAGES = 256;
+
+// most partitions a spilling hash join splits its inputs into per pass
+const int JOINMAXPARTS = 16;
+
+// partitioning passes after which a partition is joined in memory anyway
+const int JOINMAXDEPTH = 3;
+
+// how QU_Join evaluates an EQ join
+enum JoinMethod
+{
+    HASHJOIN,     // Grace hash join
+    SORTMERGEJOIN // external sort of both inputs, then a merge
+};
+
+// Joins the relations of attr1 and attr2 on "attr1 op attr2" and writes the
+// projection of every matching pair of records into result, which must
+// already exist, the way QU_Select does for a single relation.
+//
+// EQ joins are hash joins that build on the smaller relation and probe with
+// the larger. A build side that does not fit in JOINMEMPAGES is first split,
+// together with the probe side, into partitions on the hash of the join
+// attribute (Grace hash join); the partitions are temporary heap files, so
+// they go through the buffer manager like any relation, and each pair of
+// partitions is joined on its own.
+//
+// With SORTMERGEJOIN both relations are sorted on the join attribute with
+// sortHeapFile and merged; the result then comes out in join attribute
+// order. Other operators use a nested loop join, whose outer relation is
+// picked by cost when both relations have statistics (see stats.h).
+// STRING attributes of different lengths can only be joined with EQ.
+const Status QU_Join(const string &result,
+                     const int projCnt,
+                     const attrInfo projNames[],
+                     const attrInfo *attr1,
+                     const Operator op,
+                     const attrInfo *attr2,
+                     const JoinMethod method = HASHJOIN);
+
+#endif
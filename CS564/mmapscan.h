@@ -0,0 +1,51 @@
+#ifndef MMAPSCAN_H
+#define MMAPSCAN_H
+
+#include "heapfile.h"
+#include "predicate.h"
+
+// A read-only scan that maps the relation's DB file into memory and walks the
+// page chain in place. Pages are never read through the buffer pool, so a
+// large scan of a cold relation neither copies pages into bufPool nor evicts
+// anything from it. Records returned by getRecord point into the mapping and
+// stay valid until the scan is destroyed.
+//
+// The relation must not be open through a HeapFile while the scan is alive:
+// the constructor flushes the relation's pages out of the buffer pool so the
+// mapping sees the current contents, and fails with PAGEPINNED otherwise.
+class MappedFileScan
+{
+public:
+    MappedFileScan(const string &name, Status &status);
+    ~MappedFileScan();
+
+    // same parameters and checks as HeapFileScan::startScan
+    const Status startScan(const int offset,
+                           const int length,
+                           const Datatype type,
+                           const char *filter,
+                           const Operator op);
+    const Status endScan();
+
+    // next record that matches the predicate, FILEEOF at the end
+    const Status scanNext(RID &outRid);
+
+    // current record, pointing into the mapped file
+    const Status getRecord(Record &rec);
+
+    const int getRecCnt() const;
+
+private:
+    const Status mapPage(const int pageNo, Page *&page) const;
+
+    int unixFile;         // descriptor the mapping was made from
+    char *base;           // start of the mapped file
+    size_t mapLen;        // bytes mapped
+    FileHdrPage *hdrPage; // header page, in place
+    Page *curPage;        // page the scan is on, in place
+    int curPageNo;
+    RID curRec;
+    ScanPredicate pred;
+};
+
+#endif
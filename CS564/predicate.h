@@ -0,0 +1,53 @@
+#ifndef PREDICATE_H
+#define PREDICATE_H
+
+#include "heapfile.h"
+
+// BADSCANPARM unless offset, length, type and op describe a valid
+// predicate; shared by HeapFileScan::startScan and ScanPredicate::set
+const Status checkScanParms(const int offset,
+                            const int length,
+                            const Datatype type,
+                            const Operator op);
+
+// true if the attribute at offset in data satisfies "attr op filter"; a
+// record too short to hold it doesn't. Shared by HeapFileScan::matchRec
+// and ScanPredicate::match.
+const bool matchAttr(const char *data,
+                     const int len,
+                     const int offset,
+                     const int length,
+                     const Datatype type,
+                     const char *filter,
+                     const Operator op);
+
+// A single-attribute scan predicate (attr op constant), evaluated with
+// matchAttr like HeapFileScan::matchRec. Used by scans that walk pages
+// without going through HeapFileScan.
+class ScanPredicate
+{
+public:
+    ScanPredicate();
+
+    // same parameters and checks as HeapFileScan::startScan;
+    // a NULL filter matches every record
+    const Status set(const int offset_,
+                     const int length_,
+                     const Datatype type_,
+                     const char *filter_,
+                     const Operator op_);
+
+    // true if the record data satisfies the predicate
+    const bool match(const char *data, const int len) const;
+
+    const bool isSet() const { return filter != NULL; }
+
+private:
+    int offset;
+    int length;
+    Datatype type;
+    const char *filter;
+    Operator op;
+};
+
+#endif
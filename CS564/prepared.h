@@ -0,0 +1,177 @@
+#ifndef PREPARED_H
+#define PREPARED_H
+
+#include <vector>
+#include "catalog.h"
+#include "projection.h"
+#include "dict.h"
+#include "arena.h"
+
+class TupleIterator;
+class ExplainIterator;
+
+// Prepared forms of QU_Select, QU_Insert and QU_Delete. prepare() resolves
+// every name against the catalog once; execute() only binds the constants
+// and runs. The catalog cache version is remembered at prepare time and a
+// statement whose relations changed since is resolved again on its next
+// execute, so a prepared statement never runs against a stale schema.
+//
+// QU_Select, QU_Insert and QU_Delete themselves prepare a statement and
+// execute it once.
+
+// no LIMIT on a select
+const int NOLIMIT = -1;
+
+// SELECT projNames INTO result FROM ... WHERE attr op ?
+class PreparedSelect
+{
+public:
+    PreparedSelect();
+
+    const Status prepare(const string &result,
+                         const int projCnt,
+                         const attrInfo projNames[],
+                         const attrInfo *attr,
+                         const Operator op);
+
+    // run with attrValue as the constant (ignored without a predicate)
+    // and write the selected tuples into the result relation
+    const Status execute(const char *attrValue);
+
+    // the plan for attrValue, to be pulled by the caller instead of writing
+    // the result relation; the caller deletes it before the next execute,
+    // which reuses the buffers the plan had in the statement's arena
+    const Status makePlan(const char *attrValue, TupleIterator *&plan);
+
+    // evaluate scans in column batches rather than a tuple at a time
+    void setVectorized(const bool vectorized_) { vectorized = vectorized_; }
+
+    // read full scans straight out of the mapped DB file rather than through
+    // the buffer pool; for analytical scans of relations nothing else has open
+    void setMapped(const bool mapped_) { mapped = mapped_; }
+
+    // run like execute() with every operator of the plan metered, and
+    // print the plan with the rows, buffer pool traffic and time of each
+    const Status explainAnalyze(const char *attrValue, ostream &out);
+
+    // keep only the first limit tuples (NOLIMIT for all of them); with an
+    // orderBy attribute of the relation, the first in ascending order of it
+    const Status setLimit(const int limit, const attrInfo *orderBy);
+
+private:
+    const Status resolve();
+    TupleIterator *batchPlan(const string &relation, const bool filtered,
+                             const char *attrValue, const CodeFilter *codeFilter);
+    TupleIterator *instrument(TupleIterator *op, const string &label);
+
+    string result;
+    vector<attrInfo> projNames;
+    bool hasAttr;
+    attrInfo attr;
+    Operator op;
+    bool vectorized;
+    bool mapped;
+    int limit;
+    bool hasOrderBy;
+    attrInfo orderBy;
+    bool explaining;            // makePlan meters the operators it builds
+    ExplainIterator *topOp;     // last operator metered by makePlan
+
+    unsigned int version;      // catalog cache version when resolved
+    bool resolved;
+    vector<AttrDesc> projDescs;
+    AttrDesc attrDesc;
+    StringDict *dict;          // dictionary of the predicate attribute, or NULL
+    AttrDesc orderDesc;
+    Projection projection;
+    Arena arena;               // buffers of the current plan
+};
+
+// INSERT INTO relation (attrList) VALUES (?, ...)
+class PreparedInsert
+{
+public:
+    PreparedInsert();
+    ~PreparedInsert();
+
+    // attrList gives the names and types of the values, in execute order
+    const Status prepare(const string &relation, const int attrCnt, const attrInfo attrList[]);
+
+    // insert one record; values[i] is the value of attrList[i]
+    const Status execute(const char *const values[]);
+
+private:
+    // where one value goes in the record
+    struct Slot
+    {
+        int attrOffset;
+        int attrLen;
+        int attrType;     // type the value is given in
+        StringDict *dict; // dictionary of an encoded attribute, or NULL
+    };
+
+    const Status resolve();
+
+    string relation;
+    vector<attrInfo> attrList;
+
+    unsigned int version;
+    bool resolved;
+    vector<Slot> slots;
+    Arena arena;                // record buffer, until the next resolve
+    char *recData;
+    int recLen;
+    InsertFileScan *insertScan; // kept open between executes
+};
+
+// DELETE FROM relation WHERE attrName op ?
+class PreparedDelete
+{
+public:
+    PreparedDelete();
+
+    // an empty attrName deletes every record
+    const Status prepare(const string &relation, const string &attrName,
+                         const Operator op, const Datatype type);
+
+    const Status execute(const char *attrValue);
+
+private:
+    const Status resolve();
+
+    string relation;
+    string attrName;
+    Operator op;
+    Datatype type;
+
+    unsigned int version;
+    bool resolved;
+    AttrDesc attrDesc;
+    StringDict *dict;
+};
+
+// Like QU_Select, but only the first limit records satisfying the
+// predicate are written to result; with orderBy, the first limit of them in
+// ascending order of orderBy (ORDER BY ... LIMIT). A plain limit stops the
+// scan as soon as it is reached; ORDER BY with a limit keeps a heap of the
+// best limit records during a single scan instead of sorting.
+const Status QU_SelectLimit(const string &result,
+                            const int projCnt,
+                            const attrInfo projNames[],
+                            const attrInfo *attr,
+                            const Operator op,
+                            const char *attrValue,
+                            const attrInfo *orderBy,
+                            const int limit);
+
+// EXPLAIN ANALYZE of QU_Select: runs it and prints its plan to out with the
+// rows, buffer pool traffic and time of every operator
+const Status QU_ExplainSelect(const string &result,
+                              const int projCnt,
+                              const attrInfo projNames[],
+                              const attrInfo *attr,
+                              const Operator op,
+                              const char *attrValue,
+                              ostream &out);
+
+#endif
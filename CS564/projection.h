@@ -0,0 +1,64 @@
+#ifndef PROJECTION_H
+#define PROJECTION_H
+
+#include "catalog.h"
+#include "dict.h"
+
+// one contiguous run of bytes copied from a scanned record into a projected tuple
+struct ProjSegment
+{
+    int srcOffset; // offset of the run in the source record
+    int len;       // number of bytes in the run
+};
+
+// A projection list compiled once per query. Attribute names are resolved
+// to (srcOffset, len) runs up front and runs that are adjacent in both the
+// source record and the output tuple are merged, so projecting a record is
+// just a few memcpy calls.
+class Projection
+{
+public:
+    Projection();
+    ~Projection();
+
+    // build the segment list from catalog descriptors, in output order
+    const Status compile(const int projCnt, const AttrDesc projDescs[]);
+
+    // copy the projected fields of src into dst (at least getTupleLen() bytes)
+    void apply(const char *src, char *dst) const;
+
+    const int getTupleLen() const { return tupleLen; }
+    const int getSrcLen() const { return srcLen; }
+    const int getSegCnt() const { return segCnt; }
+
+private:
+    ProjSegment *segs;
+    int segCnt;
+    int tupleLen; // length of a projected tuple
+    int srcLen;   // minimum source record length the segments touch
+};
+
+// A HeapFileScan that writes the projection of each matching record
+// straight into a caller-supplied output buffer.
+class ProjectedFileScan : public HeapFileScan
+{
+public:
+    ProjectedFileScan(const string &name, Status &status);
+
+    // projection to apply in scanNext; must outlive the scan
+    void setProjection(const Projection *proj_) { proj = proj_; }
+
+    // extra code set test for an encoded attribute, on top of the
+    // startScan predicate; must outlive the scan
+    void setCodeFilter(const CodeFilter *codeFilter_) { codeFilter = codeFilter_; }
+
+    // next matching record, projected into outTuple
+    const Status scanNext(RID &outRid, char *outTuple);
+    using HeapFileScan::scanNext;
+
+private:
+    const Projection *proj;
+    const CodeFilter *codeFilter;
+};
+
+#endif
@@ -0,0 +1,21 @@
+#ifndef SCANSTATS_H
+#define SCANSTATS_H
+
+// Record counters kept by the heap file layer, per thread. HeapFileScan
+// counts the records its predicate looked at and returned and the data
+// pages it moved to; InsertFileScan counts the records it appended.
+// EXPLAIN ANALYZE (explain.h) reads them before and after each operator.
+struct ScanStats
+{
+    long long examined;
+    long long returned;
+    long long pages;
+    long long inserted;
+};
+
+// __thread is the GCC and Clang spelling of C++11 thread_local. It is used
+// here because it works with pre-C++11 compilers and, for a plain struct
+// like this, costs no more to reach than a global.
+extern __thread ScanStats scanStats;
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <pthread.h>
+#include <vector>
+#include <set>
+#include "catalog.h"
+
+// longest message payload a server accepts
+const int SRVMAXMSG = 64 * 1024;
+
+// bytes of result tuples sent in one SRV_ROWS message, at most
+const int SRVBATCHBYTES = 32 * 1024;
+
+// longest constant or value in a request, NUL included
+const int SRVMAXVALUE = 256;
+
+// Wire protocol. Every message is an SrvMsgHdr followed by len bytes of
+// payload, in the host's byte order (both ends are on the same machine).
+// A client sends one request at a time and reads until SRV_DONE or
+// SRV_ERROR before sending the next.
+enum SrvMsgType
+{
+    SRV_SELECT = 1, // request: SrvSelectReq + projCnt attribute names
+    SRV_INSERT = 2, // request: SrvInsertReq + attrCnt SrvValues
+    SRV_SCHEMA = 3, // reply to SRV_SELECT: one SrvAttr per projected attribute
+    SRV_ROWS = 4,   // reply to SRV_SELECT: result tuples, back to back
+    SRV_DONE = 5,   // request finished: SrvDone
+    SRV_ERROR = 6   // request failed: SrvDone with the error
+};
+
+struct SrvMsgHdr
+{
+    int type; // SrvMsgType
+    int len;  // bytes of payload that follow
+};
+
+// a select of relName, followed by projCnt attribute names of MAXNAME bytes
+struct SrvSelectReq
+{
+    char relName[MAXNAME];
+    char attrName[MAXNAME];  // predicate attribute, empty for none
+    int op;                  // Operator of the predicate
+    int limit;               // most tuples to return, -1 for all
+    int projCnt;
+    char value[SRVMAXVALUE]; // predicate constant as text
+};
+
+// an insert into relName, followed by attrCnt SrvValues
+struct SrvInsertReq
+{
+    char relName[MAXNAME];
+    int attrCnt;
+};
+
+struct SrvValue
+{
+    char attrName[MAXNAME];
+    int attrType;            // Datatype the value is given in
+    char value[SRVMAXVALUE]; // as text
+};
+
+// one attribute of the tuples in SRV_ROWS, in tuple order; dictionary
+// encoded STRINGs come as their INTEGER codes
+struct SrvAttr
+{
+    char attrName[MAXNAME];
+    int attrType;
+    int attrLen;
+};
+
+struct SrvDone
+{
+    int status; // OK, or the Status the request failed with
+    int rowCnt; // tuples sent or records inserted
+};
+
+struct SrvSession;
+
+// A server sharing one buffer pool, catalog and log among the clients of a
+// Unix domain socket.
+//
+// There is one worker thread per core, each with its own epoll loop; all of
+// them wait on the listening socket (EPOLLEXCLUSIVE, so a connection wakes
+// just one) and a session stays with the worker that accepted it. Socket
+// I/O runs in parallel. Statements do not: the buffer manager and catalogs
+// are not thread safe, so a worker holds the engine lock while it runs one.
+//
+// A select runs to completion under the lock, its tuples written to a
+// temporary heap file the session owns, and is sent from there a batch at
+// a time as the client reads. Each batch is read under the lock and leaves
+// nothing pinned, so a slow reader holds no pins, a result is bounded by
+// the disk rather than memory, and no other statement can change a
+// relation under a select. An insert appends its commit record
+// under the lock but waits for the log sync outside it (see
+// LogMgr::deferCommits), so the inserts of many sessions share syncs while
+// other statements run. Temporary files a session leaves behind are
+// dropped when it disconnects. A client that sends more than one request
+// before reading the reply is disconnected.
+class Server
+{
+public:
+    // listen on socketPath, replacing a stale socket file there; threadCnt
+    // workers, or one per core if it is 0
+    Server(const string &socketPath, const int threadCnt, Status &status);
+    ~Server();
+
+    // serve until stop() is called
+    const Status run();
+
+    // make run() return; safe to call from a signal handler
+    void stop();
+
+private:
+    static void *workerMain(void *arg);
+    void serve();
+    void accept(const int epfd, std::set<SrvSession *> &sessions);
+    const bool process(SrvSession *s);
+    const bool flush(SrvSession *s);
+    void pump(SrvSession *s);
+    void handle(SrvSession *s, const SrvMsgHdr &hdr, const char *payload);
+    void handleSelect(SrvSession *s, const char *payload, const int len);
+    void handleInsert(SrvSession *s, const char *payload, const int len);
+    void finish(SrvSession *s, const int type, const Status status);
+    void closeSession(SrvSession *s);
+
+    string socketPath;
+    int listenFd;
+    int stopPipe[2];
+    int threadCnt;
+    pthread_mutex_t engine; // held while the query layer runs
+};
+
+// called with each SRV_ROWS batch of a select as it arrives
+typedef void (*SrvRowHandler)(const char *tuples, const int cnt, const int tupleLen, void *arg);
+
+// A blocking client of a Server.
+class ServerClient
+{
+public:
+    ServerClient();
+    ~ServerClient();
+
+    const Status open(const string &socketPath);
+    void close();
+
+    // run req, whose projection is projNames; schema is set from
+    // SRV_SCHEMA and onRows gets every batch. Returns the request's status.
+    const Status select(const SrvSelectReq &req, const vector<string> &projNames,
+                        vector<SrvAttr> &schema, SrvRowHandler onRows, void *arg, int &rowCnt);
+
+    const Status insert(const string &relation, const int attrCnt, const SrvValue values[]);
+
+private:
+    const Status sendMsg(const int type, const vector<char> &payload);
+    const Status recvMsg(SrvMsgHdr &hdr, vector<char> &payload);
+
+    int fd;
+};
+
+#endif
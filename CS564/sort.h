@@ -0,0 +1,31 @@
+#ifndef SORT_H
+#define SORT_H
+
+#include "catalog.h"
+
+// memory an external sort may use for its runs, in pages
+const int SORTMEMPAGES = 256;
+
+// most runs merged at once
+const int SORTMAXFANIN = 16;
+
+// Sorts the records of the heap file inFile, recLen bytes each, ascending
+// on the attribute key, into a new temporary heap file outFile; scanning
+// outFile returns the records in order. The caller destroys outFile with
+// destroyHeapFile.
+//
+// Runs of up to memPages pages of records are sorted in memory and written
+// out as temporary heap files, then merged SORTMAXFANIN at a time until one
+// is left. Every run is written and read front to back through the buffer
+// manager, so inputs far larger than memory sort with sequential I/O.
+const Status sortHeapFile(const string &inFile, const int recLen, const AttrDesc &key,
+                          const int memPages, string &outFile);
+
+// Like QU_Select without a predicate, but the records of attr's relation
+// are written to result in ascending order of attr (ORDER BY).
+const Status QU_OrderBy(const string &result,
+                        const int projCnt,
+                        const attrInfo projNames[],
+                        const attrInfo *attr);
+
+#endif
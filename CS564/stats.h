@@ -0,0 +1,104 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <map>
+#include <vector>
+#include "catalog.h"
+
+// name of the heap file holding the statistics gathered by ANALYZE
+#define STATCATNAME "statcat"
+
+// records of a relation ANALYZE looks at, chosen uniformly from all of them
+const int STATSAMPLEROWS = 30000;
+
+// buckets of an equi-depth histogram
+const int STATBUCKETS = 16;
+
+// bytes of a value kept in the statistics; longer STRINGs keep a prefix
+const int STATKEYLEN = 16;
+
+// a heap scan reads pages in file order, an index lookup wherever its
+// RIDs point; a random page read is costed as this many sequential ones
+const double STATRANDOMCOST = 4.0;
+
+// one statcat record: what ANALYZE found out about one attribute
+struct AttrStats
+{
+    char relName[MAXNAME];
+    char attrName[MAXNAME];
+    int attrType;
+    int keyLen;    // bytes of each bound, min(attrLen, STATKEYLEN)
+    int rowCnt;    // records in the relation
+    int pageCnt;   // data pages holding them
+    int distinct;  // estimated distinct values
+    int bucketCnt; // histogram buckets, 0 for an empty relation
+    // bounds[0] is the smallest value and bounds[bucketCnt] the largest;
+    // bucket i, from bounds[i] to bounds[i+1], holds about
+    // rowCnt / bucketCnt of the records
+    char bounds[STATBUCKETS + 1][STATKEYLEN];
+};
+
+// Gathers and keeps per-attribute statistics and estimates from them what
+// a predicate or an access path costs.
+//
+// analyze() samples up to STATSAMPLEROWS records of a relation in one scan
+// and replaces its statcat entries: the record and page counts, and for
+// every attribute the number of distinct values (estimated from the sample
+// with the Haas-Stokes Duj1 estimator), the smallest and largest value and
+// an equi-depth histogram. Statistics are read from statcat once. Writers
+// keep the record and page counts current in memory and drop what they
+// make wrong; what statcat holds is as of the last analyze().
+class StatsMgr
+{
+public:
+    StatsMgr(Status &status);
+
+    // gather the statistics of relation
+    const Status analyze(const string &relation);
+
+    // forget the statistics of relation
+    const Status dropRelation(const string &relation);
+
+    // delta records were added to relation (removed, if negative): the
+    // record count follows and the page count grows or shrinks with it
+    void addRows(const string &relation, const int delta);
+
+    // the values of relation.attrName were overwritten, so its histogram
+    // no longer holds; forgotten until the next analyze()
+    void dropAttr(const string &relation, const string &attrName);
+
+    // statistics of relation.attrName, ATTRNOTFOUND if it wasn't analyzed
+    const Status getStats(const string &relation, const string &attrName, const AttrStats *&stats) const;
+
+    // record and page counts of relation as of its last analyze()
+    const Status getRelStats(const string &relation, int &rowCnt, int &pageCnt) const;
+
+    // estimated fraction of the records satisfying "attr op value", where
+    // value is given as text like QU_Select's attrValue; a fixed guess for
+    // attributes that weren't analyzed
+    const double selectivity(const AttrDesc &attr, const Operator op, const char *value) const;
+
+private:
+    typedef std::pair<string, string> AttrKey;
+
+    const double fractionBelow(const AttrStats &stats, const char *value) const;
+
+    std::map<AttrKey, AttrStats> attrStats;
+};
+
+// the statistics manager; NULL when statistics are not kept
+extern StatsMgr *statsMgr;
+
+// Page reads estimated for each way of finding the records of relation
+// that satisfy a predicate of the given selectivity, in sequential page
+// reads. Index lookups fetch every matching record through its RID, so
+// they cost about one random page per match until the matches cover the
+// relation, plus indexPages for the index itself.
+const double heapScanCost(const int pageCnt);
+const double indexScanCost(const int rowCnt, const int pageCnt, const double selectivity,
+                           const int indexPages);
+
+// ANALYZE relation
+const Status QU_Analyze(const string &relation);
+
+#endif
@@ -0,0 +1,67 @@
+#ifndef TEMPFILE_H
+#define TEMPFILE_H
+
+#include <map>
+#include <set>
+#include "catalog.h"
+
+// Creates an empty heap file for an operator's intermediate results (spill
+// partitions, sorted runs) under a name no relation uses; tag says what it
+// is for. Its records are recLen bytes, stored on FixedPages if they fit.
+// The file is temporary (see TempRelMgr); the caller destroys it with
+// destroyHeapFile when done.
+const Status createTempHeapFile(const string &tag, const int recLen, string &fileName);
+
+// The temporary relations and heap files of the session.
+//
+// They are never logged, and each is kept open from creation to
+// destruction, so the last HeapFile on one closing does not flush it and
+// its pages stay in the buffer pool until evicted. Destroying one drops its
+// pages from the buffer pool with BufMgr::discardFile instead of writing
+// them back; a page of a temporary file only reaches the disk if the buffer
+// pool needs its frame.
+// Whatever is left at the end of the session goes with dropAll().
+//
+// A server running many sessions tells it which session is running with
+// setOwner(); what that session leaves behind goes with dropOwned().
+class TempRelMgr
+{
+public:
+    TempRelMgr();
+
+    // create a relation, with catalog entries and a file of FixedPages, that
+    // lives until destroyRel() or the end of the session
+    const Status createRel(const string &relation, const int attrCnt, const attrInfo attrList[]);
+
+    // destroy a temporary relation and its catalog entries
+    const Status destroyRel(const string &relation);
+
+    // make the existing heap file fileName temporary
+    const Status add(const string &fileName);
+
+    // destroy a temporary heap file without writing back its pages;
+    // destroyHeapFile comes here for temporary files
+    const Status destroy(const string &fileName);
+
+    const bool isTemp(const string &fileName) const { return files.count(fileName) != 0; }
+
+    // the session creating temporary files from now on, NULL for none
+    void setOwner(const void *owner_) { owner = owner_; }
+
+    // destroy everything still temporary that owner created
+    const Status dropOwned(const void *owner);
+
+    // destroy everything still temporary; call at the end of the session,
+    // while the buffer manager and catalogs are still there
+    const Status dropAll();
+
+private:
+    std::map<string, File *> files; // the open File of each temporary heap file
+    std::set<string> rels;          // the ones that are relations in the catalog
+    std::map<string, const void *> ownerOf;
+    const void *owner;
+};
+
+extern TempRelMgr tempRels;
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef UPDATE_H
+#define UPDATE_H
+
+#include "catalog.h"
+
+// Sets the attributes in setList to their attrValues in every record of
+// relation satisfying "attrName op attrValue" (every record if attrName is
+// empty). Attributes are at fixed offsets, so each record is overwritten
+// where it is, in a single scan, and keeps its RID. Index entries are only
+// rewritten when one of the set attributes is indexed.
+//
+// Returns OK on success, ATTRNOTFOUND if a set attribute is not in the
+// relation, or the first error from the scan.
+const Status QU_Update(const string &relation,
+                       const int setCnt,
+                       const attrInfo setList[],
+                       const string &attrName,
+                       const Operator op,
+                       const Datatype type,
+                       const char *attrValue);
+
+#endif
@@ -0,0 +1,128 @@
+#ifndef WAL_H
+#define WAL_H
+
+#include <pthread.h>
+#include <map>
+#include <set>
+#include "heapfile.h"
+
+// kinds of log records
+enum LogRecType
+{
+    LOG_PAGE = 1,   // after-image of a page
+    LOG_ALLOC = 2,  // page allocated in a DB file
+    LOG_COMMIT = 3, // everything logged before this record is committed
+    LOG_UNDO = 4    // before-image of a page, for a change that may not commit
+};
+
+// fixed header in front of every log record; LOG_PAGE and LOG_UNDO records
+// are followed by a PAGESIZE page image
+struct LogRecHdr
+{
+    int type;
+    int pageNo;
+    int len;               // bytes of payload following the header
+    unsigned int checksum; // over header (with checksum 0) and payload
+    char fileName[MAXNAMESIZE];
+};
+
+// The write-ahead log for heap file and index changes.
+//
+// Record inserts, record deletes, index updates and page allocations log the
+// after-image of every page they touch; pages of temporary files (see
+// tempfile.h) are not logged. Images of the same page logged between two
+// commit records are collapsed into one, so a batch of inserts into the
+// same page logs that page once. commit() makes everything logged so far
+// durable with a single sequential write and fdatasync of the log;
+// concurrent committers wait for whichever of them is flushing and share
+// its fsync (group commit).
+//
+// The buffer manager may write a changed page back before it is committed,
+// so the first change to a page after a commit record also logs the page's
+// disk contents as a before-image, and the page is not written back until
+// that image is on disk (flushForPage). recover() runs at startup, before
+// any relation is opened: it puts back the before-images logged after the
+// last commit record, then replays every committed change over them.
+// checkpoint() flushes the logged files and truncates the log; call it
+// between statements.
+//
+// A thread that runs statements under a lock of its own can deferCommits()
+// first: commit() then only appends the commit record, in statement order,
+// and the thread waits for it with waitDeferred() once it has dropped its
+// lock, so other statements run while the log is synced.
+class LogMgr
+{
+public:
+    LogMgr(const string &logName, Status &status);
+    ~LogMgr();
+
+    // log the current contents of page pageNo of file, which was just
+    // changed; the first change since the last commit also logs what the
+    // page holds on disk
+    const Status logPage(File *file, const char *fileName, const int pageNo, const Page *page);
+
+    // log that pageNo was allocated in fileName; it needs no before-image
+    const Status logAlloc(const char *fileName, const int pageNo);
+
+    // returns once page pageNo of file may be written back, i.e. once the
+    // before-image of its uncommitted change, if it has one, is on disk.
+    // The buffer manager calls this before writing any dirty page.
+    const Status flushForPage(const File *file, const int pageNo);
+
+    // returns once everything logged so far is on disk; with commits
+    // deferred, only appends the commit record
+    const Status commit();
+
+    // defer this thread's commits until waitDeferred()
+    void deferCommits();
+
+    // stop deferring this thread's commits and return once the last of
+    // them is on disk
+    const Status waitDeferred();
+
+    // replay committed batches into the DB files, then truncate the log
+    const Status recover();
+
+    // write back and sync every file logged since the last checkpoint and
+    // truncate the log. Returns PAGEPINNED if one of them is still in use.
+    const Status checkpoint();
+
+    // microseconds a flushing committer waits for others to join its batch
+    void setCommitDelay(const int usecs) { commitDelay = usecs; }
+
+private:
+    typedef std::pair<string, int> PageKey;
+    typedef std::pair<const File *, int> FramePageKey;
+
+    const Status append(const int type, const char *fileName, const int pageNo,
+                        const char *payload, const int len);
+    const Status waitDurable(const long long lsn);
+    const Status flushLog(const char *buf, const int len);
+    const Status redo(const LogRecHdr *hdr, const char *payload);
+    const Status syncFile(const string &fileName);
+
+    string logName;
+    int logFile;
+
+    pthread_mutex_t mutex;
+    pthread_cond_t flushed;
+
+    char *fillBuf;        // records appended since the last flush started
+    int fillLen;
+    int fillCap;
+    long long fillEndLsn; // bytes ever appended, up to the end of fillBuf
+    long long durableLsn; // bytes ever appended that are known to be on disk
+    bool flushing;        // a committer is writing the log
+    int commitDelay;
+    Status logStatus;     // first log write error, OK if none
+
+    std::map<PageKey, int> imageAt;  // offset in fillBuf of each page's image since the last commit record
+    std::set<PageKey> batchPages;    // pages with a before-image or allocated since the last commit record
+    std::map<FramePageKey, long long> undoLsn; // end of each before-image not known to be on disk
+    std::set<string> dirtyFiles;     // files logged since the last checkpoint
+};
+
+// the log used by the heap file layer; NULL disables logging
+extern LogMgr *logMgr;
+
+#endif